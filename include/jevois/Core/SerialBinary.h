@@ -0,0 +1,182 @@
+// ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// JeVois Smart Embedded Machine Vision Toolkit - Copyright (C) 2016 by Laurent Itti, the University of Southern
+// California (USC), and iLab at USC. See http://iLab.usc.edu and http://jevois.org for information about this project.
+//
+// This file is part of the JeVois Smart Embedded Machine Vision Toolkit.  This program is free software; you can
+// redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software
+// Foundation, version 2.  This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+// License for more details.  You should have received a copy of the GNU General Public License along with this program;
+// if not, write to the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+//
+// Contact information: Laurent Itti - 3641 Watt Way, HNB-07A - Los Angeles, CA 90089-2520 - USA.
+// Tel: +1 213 740 3527 - itti@pollux.usc.edu - http://iLab.usc.edu - http://jevois.org
+// ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file */
+
+// This file is plain C (C99) so that it can be included as-is in the code of a microcontroller (e.g., Arduino) that
+// receives binary standardized serial messages from JeVois. It is also used by jevois::StdModule to encode them.
+
+#ifndef JEVOIS_CORE_SERIALBINARY_H
+#define JEVOIS_CORE_SERIALBINARY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /*! \defgroup serialbinary Binary standardized serial messages
+
+      Binary framing of the standardized serial messages of \ref UserSerialStyle, used when parameter \c serstyle of
+      jevois::StdModule is \b Binary. Each frame is:
+
+      \verbatim
+      sync0 (0xA5) | sync1 (0x5A) | len (u16) | type (u8) | seq (u16) | payload (len bytes) | crc (u16)
+      \endverbatim
+
+      All multi-byte values are little-endian. \a seq is the low 16 bits of the video frame number at the time the
+      message was sent, so that messages about a same frame can be grouped. \a crc is CRC-16/CCITT-FALSE (polynomial
+      0x1021, initial value 0xFFFF) computed over all bytes from \a len through the end of the payload.
+
+      The payload starts with fixed-point signed 16-bit coordinates, whose meaning depends on \a type (see
+      jvbin_type). 1D and 2D coordinates are in units of 0.1 standardized coordinate (see \ref coordhelpers), 3D
+      coordinates are in millimeters, and quaternion components are Q14 fixed-point (i.e., 16384 means 1.0). Values
+      that do not fit are saturated. The payload then ends with the \a id string (u8 length followed by the
+      characters, not zero-terminated) and the \a extra string (same encoding).
+
+      \ingroup core */
+
+  /*! @{ */ // **********************************************************************
+
+  //! First sync byte of a binary frame
+#define JVBIN_SYNC0 0xA5
+
+  //! Second sync byte of a binary frame
+#define JVBIN_SYNC1 0x5A
+
+  //! Number of bytes in a frame, not counting the payload
+#define JVBIN_OVERHEAD 9
+
+  //! Max number of vertices in a JVBIN_2D_POLY or JVBIN_3D_POLY message, longer polygons are truncated by JeVois
+#define JVBIN_MAX_VERTICES 255
+
+  //! Max length of the id and extra strings, longer strings are truncated by JeVois
+#define JVBIN_MAX_STRING 255
+
+  //! Largest payload that JeVois may send: a 3D polygon with the max number of vertices, id and extra (2043 bytes)
+#define JVBIN_MAX_ENCODED_PAYLOAD (1 + JVBIN_MAX_VERTICES * 6 + 2 * (1 + JVBIN_MAX_STRING))
+
+  //! Max payload size accepted by jvbin_decode()
+  /*! Defaults to JVBIN_MAX_ENCODED_PAYLOAD so that no valid frame is ever discarded. A jvbin_decoder holds one payload,
+      hence it then uses a bit over 2 KB of RAM, which is too much for small microcontrollers (e.g., Arduino Uno has 2
+      KB of RAM in total). Define a smaller value before including this header in that case: frames with a larger
+      payload are then discarded and counted in jvbin_decoder::errors. 1D, 2D and 3D messages with id and extra
+      strings of up to 32 characters each fit in 128 bytes; each polygon vertex adds 4 bytes in 2D and 6 in 3D. */
+#ifndef JVBIN_MAX_PAYLOAD
+#define JVBIN_MAX_PAYLOAD JVBIN_MAX_ENCODED_PAYLOAD
+#endif
+
+  //! Scale factor from standardized 1D and 2D coordinates to fixed-point
+#define JVBIN_STD_SCALE 10.0F
+
+  //! Scale factor from quaternion components to fixed-point
+#define JVBIN_QUAT_SCALE 16384.0F
+
+  //! Message types
+  enum jvbin_type
+  {
+    JVBIN_FRAME_END = 0x00, //!< no payload, sent after the messages of each video frame if Engine serframe is Binary
+    JVBIN_1D = 0x01,        //!< x, size, id, extra
+    JVBIN_2D = 0x02,        //!< x, y, w, h, id, extra
+    JVBIN_3D = 0x03,        //!< x, y, z, w, h, d, q1, q2, q3, q4, id, extra
+    JVBIN_2D_POLY = 0x12,   //!< n (u8), n * (x, y), id, extra
+    JVBIN_3D_POLY = 0x13    //!< n (u8), n * (x, y, z), id, extra
+  };
+
+  //! Update a CRC-16/CCITT-FALSE with one byte
+  static inline uint16_t jvbin_crc16_update(uint16_t crc, uint8_t byte)
+  {
+    int i;
+    crc ^= (uint16_t)byte << 8;
+    for (i = 0; i < 8; ++i) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    return crc;
+  }
+
+  //! Compute a CRC-16/CCITT-FALSE over a buffer
+  static inline uint16_t jvbin_crc16(uint8_t const * data, size_t len)
+  {
+    uint16_t crc = 0xFFFF;
+    while (len--) crc = jvbin_crc16_update(crc, *data++);
+    return crc;
+  }
+
+  //! Read a little-endian signed 16-bit value, e.g., a coordinate from a decoded payload
+  static inline int16_t jvbin_get_i16(uint8_t const * p)
+  { return (int16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8)); }
+
+  //! Read a little-endian unsigned 16-bit value
+  static inline uint16_t jvbin_get_u16(uint8_t const * p)
+  { return (uint16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8)); }
+
+  //! Streaming decoder state, to be zero-initialized (or reset with jvbin_reset()) before use
+  struct jvbin_decoder
+  {
+    uint8_t state;                         //!< Internal parser state
+    uint8_t type;                          //!< Message type of the last complete frame, see jvbin_type
+    uint16_t seq;                          //!< Frame sequence number of the last complete frame
+    uint16_t len;                          //!< Payload length of the last complete frame
+    uint16_t pos;                          //!< Internal: bytes of payload received so far
+    uint16_t crc;                          //!< Internal: running CRC
+    uint16_t rxcrc;                        //!< Internal: received CRC
+    uint32_t errors;                       //!< Number of frames dropped because of bad CRC or length
+    uint8_t payload[JVBIN_MAX_PAYLOAD];    //!< Payload of the last complete frame
+  };
+
+  //! Reset a decoder
+  static inline void jvbin_reset(struct jvbin_decoder * d)
+  { d->state = 0; d->pos = 0; }
+
+  //! Feed one received byte to a decoder
+  /*! Returns 1 when a complete and valid frame has just been received, in which case its contents are in d->type,
+      d->seq, d->len and d->payload until the next call. Returns 0 otherwise. Garbage bytes (e.g., text messages sent
+      on the same port) are skipped until the next sync sequence. */
+  static inline int jvbin_decode(struct jvbin_decoder * d, uint8_t c)
+  {
+    switch (d->state)
+    {
+    case 0: if (c == JVBIN_SYNC0) d->state = 1; return 0;
+    case 1: d->state = (c == JVBIN_SYNC1) ? 2 : (c == JVBIN_SYNC0 ? 1 : 0); return 0;
+    case 2: d->crc = jvbin_crc16_update(0xFFFF, c); d->len = c; d->state = 3; return 0;
+    case 3:
+      d->crc = jvbin_crc16_update(d->crc, c); d->len |= (uint16_t)c << 8;
+      if (d->len > JVBIN_MAX_PAYLOAD) { ++d->errors; d->state = 0; } else d->state = 4;
+      return 0;
+    case 4: d->crc = jvbin_crc16_update(d->crc, c); d->type = c; d->state = 5; return 0;
+    case 5: d->crc = jvbin_crc16_update(d->crc, c); d->seq = c; d->state = 6; return 0;
+    case 6:
+      d->crc = jvbin_crc16_update(d->crc, c); d->seq |= (uint16_t)c << 8; d->pos = 0;
+      d->state = (d->len == 0) ? 8 : 7;
+      return 0;
+    case 7:
+      d->crc = jvbin_crc16_update(d->crc, c); d->payload[d->pos++] = c;
+      if (d->pos == d->len) d->state = 8;
+      return 0;
+    case 8: d->rxcrc = c; d->state = 9; return 0;
+    case 9:
+      d->rxcrc |= (uint16_t)c << 8; d->state = 0;
+      if (d->rxcrc == d->crc) return 1;
+      ++d->errors; return 0;
+    default: d->state = 0; return 0;
+    }
+  }
+
+  /*! @} */ // **********************************************************************
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JEVOIS_CORE_SERIALBINARY_H